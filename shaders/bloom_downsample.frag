@@ -0,0 +1,24 @@
+#version 330 core
+out vec4 FragColor;
+in vec2 TexCoord;
+
+// Bloom chain downsample: half -> quarter -> eighth resolution.
+uniform sampler2D uSource;
+uniform vec2 uPixel; // texel size of uSource (the larger mip)
+uniform vec2 uRenderScale; // dynamic resolution, see composite.frag
+
+// Every mip fills the bottom-left uRenderScale fraction of its target
+vec3 sampleSource(vec2 uv) {
+    return texture(uSource, min(uv, uRenderScale - 0.5 * uPixel)).rgb;
+}
+
+void main() {
+    // Four bilinear taps centred between texels average a 4x4 footprint
+    vec2 uv = TexCoord * uRenderScale;
+    vec3 color = sampleSource(uv + vec2(-uPixel.x, -uPixel.y));
+    color += sampleSource(uv + vec2( uPixel.x, -uPixel.y));
+    color += sampleSource(uv + vec2(-uPixel.x,  uPixel.y));
+    color += sampleSource(uv + vec2( uPixel.x,  uPixel.y));
+
+    FragColor = vec4(color * 0.25, 1.0);
+}
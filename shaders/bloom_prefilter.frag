@@ -0,0 +1,48 @@
+#version 330 core
+out vec4 FragColor;
+in vec2 TexCoord;
+
+// First step of the bloom chain: full resolution -> half resolution.
+// The neon-biased bright pass is folded into this downsample so the
+// full-resolution scene is read exactly once.
+uniform sampler2D uScene;
+uniform vec2 uPixel;          // texel size of uScene (the full-resolution source)
+uniform float uBloomThreshold;
+uniform float uTimeOfDay;
+uniform vec2 uRenderScale;    // dynamic resolution, see composite.frag
+
+// The scene fills the bottom-left uRenderScale fraction of its target
+vec3 sampleScene(vec2 uv) {
+    return texture(uScene, min(uv, uRenderScale - 0.5 * uPixel)).rgb;
+}
+
+vec3 brightPass(vec3 color) {
+    float brightness = dot(color, vec3(0.2126, 0.7152, 0.0722));
+
+    // Bias towards neon colors (orange and blue)
+    float neonBias = max(
+        dot(color, vec3(1.0, 0.7, 0.0)),  // Orange bias
+        dot(color, vec3(0.0, 0.7, 1.0))   // Blue bias
+    );
+
+    brightness = max(brightness, neonBias * 0.8);
+
+    // Dynamic threshold based on time of day
+    float threshold = mix(uBloomThreshold * 1.2, uBloomThreshold * 0.8, uTimeOfDay);
+
+    float bloomFactor = max(brightness - threshold, 0.0) / (1.0 - threshold);
+    return color * bloomFactor;
+}
+
+void main() {
+    // Four bilinear taps centred between texels cover a 4x4 footprint. The
+    // bright pass runs per tap, before averaging, so thin neon features such
+    // as the rim glow are thresholded at full brightness.
+    vec2 uv = TexCoord * uRenderScale;
+    vec3 color = brightPass(sampleScene(uv + vec2(-uPixel.x, -uPixel.y)));
+    color += brightPass(sampleScene(uv + vec2( uPixel.x, -uPixel.y)));
+    color += brightPass(sampleScene(uv + vec2(-uPixel.x,  uPixel.y)));
+    color += brightPass(sampleScene(uv + vec2( uPixel.x,  uPixel.y)));
+
+    FragColor = vec4(color * 0.25, 1.0);
+}
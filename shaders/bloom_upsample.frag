@@ -0,0 +1,37 @@
+#version 330 core
+out vec4 FragColor;
+in vec2 TexCoord;
+
+// Bloom chain upsample: eighth -> quarter -> half resolution.
+// Each step blurs the smaller mip with a 3x3 tent filter and blends it with the
+// matching downsampled level; the half-resolution result is uBloom in composite.frag.
+// Blending rather than adding keeps the total energy equal to the bright pass.
+uniform sampler2D uSource;   // smaller mip being upsampled
+uniform sampler2D uDetail;   // downsampled level at the output resolution
+uniform vec2 uPixel;         // texel size of uSource
+uniform float uBloomScatter; // 0..1 weight of the wider levels, ~0.7
+uniform vec2 uRenderScale;   // dynamic resolution, see composite.frag
+
+// Every mip fills the bottom-left uRenderScale fraction of its target
+vec3 sampleSource(vec2 uv) {
+    return texture(uSource, min(uv, uRenderScale - 0.5 * uPixel)).rgb;
+}
+
+// Tent filter weights: 1-2-1 / 2-4-2 / 1-2-1
+const float weights[3] = float[](0.25, 0.125, 0.0625);
+
+void main() {
+    vec2 uv = TexCoord * uRenderScale;
+    vec3 result = sampleSource(uv) * weights[0];
+    result += sampleSource(uv + vec2( uPixel.x, 0.0)) * weights[1];
+    result += sampleSource(uv + vec2(-uPixel.x, 0.0)) * weights[1];
+    result += sampleSource(uv + vec2(0.0,  uPixel.y)) * weights[1];
+    result += sampleSource(uv + vec2(0.0, -uPixel.y)) * weights[1];
+    result += sampleSource(uv + vec2( uPixel.x,  uPixel.y)) * weights[2];
+    result += sampleSource(uv + vec2(-uPixel.x,  uPixel.y)) * weights[2];
+    result += sampleSource(uv + vec2( uPixel.x, -uPixel.y)) * weights[2];
+    result += sampleSource(uv + vec2(-uPixel.x, -uPixel.y)) * weights[2];
+
+    // uv lands on uDetail texel centres inside the scaled viewport
+    FragColor = vec4(mix(texture(uDetail, uv).rgb, result, uBloomScatter), 1.0);
+}
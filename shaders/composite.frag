@@ -3,12 +3,19 @@ out vec4 FragColor;
 in vec2 TexCoord;
 
 uniform sampler2D uScene;
-uniform sampler2D uBloom;
+uniform sampler2D uBloom;    // half-resolution output of the bloom_upsample chain
 uniform sampler2D uOutlines;
 uniform float uTimeOfDay;
 uniform float uWeatherIntensity;
 uniform float uExposure;
 uniform float uGamma;
+uniform float uBloomIntensity;
+
+// Dynamic resolution: uScene, uOutlines and every bloom mip are rendered into
+// the bottom-left uRenderScale fraction of fixed-size targets and upscaled here.
+uniform vec2 uRenderScale;   // internal / output resolution, (1, 1) when unscaled
+uniform vec2 uPixel;         // texel size of uScene
+uniform vec2 uBloomPixel;    // texel size of uBloom
 
 // Color grading parameters
 uniform float uLift;
@@ -16,6 +23,13 @@ uniform float uGamma2;
 uniform float uGain;
 uniform float uSaturation;
 
+// Storm permutation (see fragment.glsl)
+#ifdef WEATHER_STORM
+#define STORM_ACTIVE bool(WEATHER_STORM)
+#else
+#define STORM_ACTIVE (uWeatherIntensity > 0.5)
+#endif
+
 // Epoch of Elria color grading
 vec3 colorGrade(vec3 color) {
     // Lift, Gamma, Gain
@@ -30,7 +44,7 @@ vec3 colorGrade(vec3 color) {
     color.b += blueBias * (1.0 - color.b);
     
     // Weather influence on color grading
-    if (uWeatherIntensity > 0.5) {
+    if (STORM_ACTIVE) {
         // Storm: desaturate and darken
         color = mix(color, vec3(dot(color, vec3(0.299, 0.587, 0.114))), uWeatherIntensity * 0.3);
         color *= (1.0 - uWeatherIntensity * 0.2);
@@ -61,13 +75,15 @@ vec3 toneMap(vec3 color) {
 }
 
 void main() {
-    // Sample all render targets
-    vec3 scene = texture(uScene, TexCoord).rgb;
-    vec3 bloom = texture(uBloom, TexCoord).rgb;
-    vec4 outline = texture(uOutlines, TexCoord);
+    // Sample all render targets, clamping inside the rendered region
+    vec2 sceneUV = min(TexCoord * uRenderScale, uRenderScale - 0.5 * uPixel);
+    vec3 scene = texture(uScene, sceneUV).rgb;
+    vec3 bloom = texture(uBloom, min(TexCoord * uRenderScale, uRenderScale - 0.5 * uBloomPixel)).rgb;
+    vec4 outline = texture(uOutlines, sceneUV);
     
-    // Combine scene and bloom
-    vec3 color = scene + bloom;
+    // Combine scene and bloom with time-based bloom intensity
+    float bloomIntensity = mix(uBloomIntensity * 0.7, uBloomIntensity * 1.3, 1.0 - uTimeOfDay);
+    vec3 color = scene + bloom * bloomIntensity;
     
     // Apply color grading
     color = colorGrade(color);
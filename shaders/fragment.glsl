@@ -1,13 +1,28 @@
 #version 330 core
+// IMPOSTOR 1 shades far platforms drawn by vertex_impostor.glsl. The normal
+// comes from the atlas instead of the mesh, and everything else is shared so
+// the far level matches the mid level exactly.
+#ifndef IMPOSTOR
+#define IMPOSTOR 0
+#endif
+
+#if IMPOSTOR
+in vec2 vUV;
+flat in float vImpostorDepthRange;
+uniform sampler2D uImpostorAtlas; // RG = octahedral world normal, B = depth offset, A = coverage
+#else
 in vec3 vNormal;
+#endif
 in vec3 vPos;
+in float vViewDepth;
+flat in vec3 vBaseColor;  // uBaseColor, or per-instance color when instanced
+flat in vec3 vAccent1;    // uAccent1 (neon orange)
+flat in vec3 vAccent2;    // uAccent2 (neon blue)
 
-out vec4 FragColor;
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out vec4 GBuffer; // RGBA8: RG = octahedral normal, BA = 16-bit log2 depth
 
 uniform vec3 uLightDir;   // normalized
-uniform vec3 uBaseColor;  // e.g., vec3(0.18, 0.25, 0.33) deep blue
-uniform vec3 uAccent1;    // vec3(1.0, 0.70, 0.07) neon orange
-uniform vec3 uAccent2;    // vec3(0.0, 0.75, 1.0) neon blue
 
 // tweakables
 uniform float uStepCount; // 2–4 tonal steps
@@ -19,42 +34,139 @@ uniform float uTimeOfDay; // 0.0 = midnight, 0.5 = noon, 1.0 = midnight
 uniform float uWeatherIntensity; // 0.0 = clear, 1.0 = storm
 uniform vec3 uFogColor;   // atmospheric fog color
 uniform float uFogDensity; // fog density
+uniform float uNearPlane;  // near and far planes bound the log2 depth written to GBuffer
+uniform float uFarPlane;
+
+// Permutation key: define WEATHER_STORM as 0 or 1 to resolve the storm branch
+// at compile time; left undefined it is tested per fragment.
+#ifdef WEATHER_STORM
+#define STORM_ACTIVE bool(WEATHER_STORM)
+#else
+#define STORM_ACTIVE (uWeatherIntensity > 0.5)
+#endif
+
+// Permutation key: define TIME_BAND_DAY as 0 or 1 to resolve the day/night
+// branch at compile time; left undefined it is tested per fragment. The loader
+// selects 1 exactly when sin(uTimeOfDay * 3.14159) > 0.0 (see SHADER_IMPLEMENTATION_PLAN.md).
+#ifdef TIME_BAND_DAY
+#define DAY_ACTIVE bool(TIME_BAND_DAY)
+#else
+#define DAY_ACTIVE (dayIntensity > 0.0)
+#endif
+
+// LOD permutations: LOD_SIMPLE drops the rim glow for distant meshes, and
+// LOD_CROSSFADE dithers between two levels while a switch is in progress.
+#if IMPOSTOR
+#undef LOD_SIMPLE
+#define LOD_SIMPLE 1
+#endif
+#ifndef LOD_SIMPLE
+#define LOD_SIMPLE 0
+#endif
+#ifndef LOD_CROSSFADE
+#define LOD_CROSSFADE 0
+#endif
+
+#if LOD_CROSSFADE
+uniform float uLodFade;   // switch progress t in [0, 1], same value on both levels
+uniform bool uLodFadeOut; // true on the outgoing level
+
+// Screen-door cross-fade; incoming and outgoing levels keep complementary pixels
+bool lodDiscard() {
+    float dither = fract(52.9829189 * fract(dot(gl_FragCoord.xy, vec2(0.06711056, 0.00583715))));
+    return uLodFadeOut ? dither < uLodFade : dither >= uLodFade;
+}
+#endif
+
+// Octahedral normal encoding, decoded by outline.frag
+vec2 octEncode(vec3 n) {
+    n /= abs(n.x) + abs(n.y) + abs(n.z);
+    if (n.z < 0.0) {
+        vec2 signs = vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+        n.xy = (1.0 - abs(n.yx)) * signs;
+    }
+    return n.xy;
+}
+
+#if IMPOSTOR
+// See outline.frag
+vec3 octDecode(vec2 f) {
+    vec3 n = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+#endif
+
+// log2 depth mapped to [0, 1]: one 16-bit quantum is the same relative
+// depth step at any distance
+float encodeDepth(float viewDepth) {
+    return log2(max(viewDepth, uNearPlane) / uNearPlane) / log2(uFarPlane / uNearPlane);
+}
+
+// 16-bit depth split across two 8-bit channels; the target must be sampled with GL_NEAREST
+vec2 packDepth16(float depth) {
+    float v = floor(clamp(depth, 0.0, 1.0) * 65535.0 + 0.5);
+    float hi = floor(v / 256.0);
+    return vec2(hi, v - hi * 256.0) / 255.0;
+}
 
 void main() {
-    // lighting
+#if LOD_CROSSFADE
+    if (lodDiscard()) {
+        discard;
+    }
+#endif
+
+#if IMPOSTOR
+    vec4 texel = texture(uImpostorAtlas, vUV);
+    if (texel.a < 0.5) {
+        discard;
+    }
+    vec3 N = octDecode(texel.rg * 2.0 - 1.0);
+    // Baked offset towards the camera restores the mesh's depth profile on the flat quad
+    float viewDepth = vViewDepth - (texel.b - 0.5) * vImpostorDepthRange;
+#else
     vec3 N = normalize(vNormal);
+    float viewDepth = vViewDepth;
+#endif
+
+    // lighting
     float ndl = max(dot(N, normalize(uLightDir)), 0.0);
 
     // quantize to steps for cel-shading
     float stepped = floor(ndl * uStepCount) / (uStepCount - 1.0);
 
     // base cel color with atmospheric influence
-    vec3 baseColor = mix(uBaseColor, uFogColor, uFogDensity * 0.3);
-    vec3 color = mix(baseColor, uAccent2, stepped + uBlueBias);
+    vec3 baseColor = mix(vBaseColor, uFogColor, uFogDensity * 0.3);
+    vec3 color = mix(baseColor, vAccent2, stepped + uBlueBias);
 
     // time of day influence
     float dayIntensity = sin(uTimeOfDay * 3.14159);
-    if (dayIntensity > 0.0) {
+    if (DAY_ACTIVE) {
         // Day: warmer tones
-        color = mix(color, uAccent1, dayIntensity * 0.2);
+        color = mix(color, vAccent1, dayIntensity * 0.2);
     } else {
         // Night: cooler, more blue
-        color = mix(color, uAccent2, abs(dayIntensity) * 0.4);
+        color = mix(color, vAccent2, abs(dayIntensity) * 0.4);
     }
 
     // weather effects
-    if (uWeatherIntensity > 0.5) {
+    if (STORM_ACTIVE) {
         // Storm: darker, more dramatic
         color *= (1.0 - uWeatherIntensity * 0.3);
         color = mix(color, vec3(0.1, 0.15, 0.25), uWeatherIntensity * 0.2);
     }
 
+#if !LOD_SIMPLE
     // accent: rim glow with atmospheric enhancement
     float rim = 1.0 - max(dot(N, normalize(-vPos)), 0.0);
     if (rim > 0.75) {
-        vec3 rimColor = mix(uAccent1, uAccent2, uTimeOfDay);
+        vec3 rimColor = mix(vAccent1, vAccent2, uTimeOfDay);
         color = mix(color, rimColor, rim * uGlow * (1.0 + uWeatherIntensity));
     }
+#endif
 
     // atmospheric fog
     float distance = length(vPos);
@@ -62,4 +174,5 @@ void main() {
     color = mix(uFogColor, color, fogFactor);
 
     FragColor = vec4(color, 1.0);
+    GBuffer = vec4(octEncode(N) * 0.5 + 0.5, packDepth16(encodeDepth(viewDepth)));
 }
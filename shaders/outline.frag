@@ -2,32 +2,55 @@
 out vec4 FragColor;
 in vec2 TexCoord;
 
-uniform sampler2D uDepth;
-uniform sampler2D uNormals;
+uniform sampler2D uGBuffer; // RGBA8 packed normal + depth (see fragment.glsl), GL_NEAREST
 uniform vec2 uPixel;
 uniform float uEdgeScale; // line width scaling
 uniform float uTimeOfDay; // for dynamic edge styling
 uniform vec3 uEdgeColor;  // edge line color
+uniform vec2 uRenderScale; // dynamic resolution, see composite.frag
+uniform float uDepthLogRange; // log2(uFarPlane / uNearPlane)
+
+vec3 octDecode(vec2 f) {
+    vec3 n = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// Decoded normal in xyz, encoded log2 depth in w (see fragment.glsl)
+vec4 readGBuffer(vec2 uv) {
+    vec4 g = texture(uGBuffer, min(uv, uRenderScale - 0.5 * uPixel));
+    float depth = dot(floor(g.ba * 255.0 + 0.5), vec2(256.0, 1.0)) / 65535.0;
+    return vec4(octDecode(g.rg * 2.0 - 1.0), depth);
+}
+
+// 1/depth is affine in screen space on any plane, so its second difference
+// across the centre tap is zero on planar surfaces at every distance and
+// angle. Returns |w_a + w_b - 2 w_c| / w_c, using w_i / w_c = exp2((L_c - L_i) * range).
+float planeDeviation(float a, float b, float c) {
+    return abs(exp2((c - a) * uDepthLogRange) + exp2((c - b) * uDepthLogRange) - 2.0);
+}
 
 void main() {
-    // Sobel edge detection on depth
-    float d00 = texture(uDepth, TexCoord + vec2(-uPixel.x, -uPixel.y)).r;
-    float d10 = texture(uDepth, TexCoord + vec2( uPixel.x, -uPixel.y)).r;
-    float d01 = texture(uDepth, TexCoord + vec2(-uPixel.x,  uPixel.y)).r;
-    float d11 = texture(uDepth, TexCoord + vec2( uPixel.x,  uPixel.y)).r;
+    // Drawn into the scaled viewport, so TexCoord spans only the rendered region
+    vec2 uv = TexCoord * uRenderScale;
 
-    float gx = d10 - d00;
-    float gy = d11 - d01;
-    float depthEdge = sqrt(gx * gx + gy * gy);
+    // One fetch per tap returns both normal and depth
+    vec4 gc = readGBuffer(uv);
+    vec4 g00 = readGBuffer(uv + vec2(-uPixel.x, -uPixel.y));
+    vec4 g10 = readGBuffer(uv + vec2( uPixel.x, -uPixel.y));
+    vec4 g01 = readGBuffer(uv + vec2(-uPixel.x,  uPixel.y));
+    vec4 g11 = readGBuffer(uv + vec2( uPixel.x,  uPixel.y));
 
-    // Sobel edge detection on normals
-    vec3 n00 = texture(uNormals, TexCoord + vec2(-uPixel.x, -uPixel.y)).rgb;
-    vec3 n10 = texture(uNormals, TexCoord + vec2( uPixel.x, -uPixel.y)).rgb;
-    vec3 n01 = texture(uNormals, TexCoord + vec2(-uPixel.x,  uPixel.y)).rgb;
-    vec3 n11 = texture(uNormals, TexCoord + vec2( uPixel.x,  uPixel.y)).rgb;
+    // Depth edges: deviation from planarity along both diagonals. At a
+    // silhouette this is roughly the relative depth gap, so the thresholds
+    // below mean a 1.5-2.5% gap; the 16-bit log2 noise floor is ~4e-4.
+    float depthEdge = max(planeDeviation(g00.w, g11.w, gc.w), planeDeviation(g10.w, g01.w, gc.w));
 
-    vec3 ngx = n10 - n00;
-    vec3 ngy = n11 - n01;
+    // Sobel edge detection on normals
+    vec3 ngx = g10.xyz - g00.xyz;
+    vec3 ngy = g11.xyz - g01.xyz;
     float normalEdge = length(ngx) + length(ngy);
 
     // Combine edge detection methods
@@ -0,0 +1,228 @@
+#version 330 core
+// Fused post-processing: spiral warp + Sobel outline + composite in one full-screen pass.
+// Equivalent to running outline.frag, composite.frag and spiral.frag in sequence,
+// without writing and reading back the intermediate targets.
+//
+// Each stage can be compiled out by injecting a define after the #version line,
+// e.g. "#define ENABLE_SPIRAL 0".
+#ifndef ENABLE_SPIRAL
+#define ENABLE_SPIRAL 1
+#endif
+#ifndef ENABLE_OUTLINE
+#define ENABLE_OUTLINE 1
+#endif
+#ifndef ENABLE_COLOR_GRADE
+#define ENABLE_COLOR_GRADE 1
+#endif
+#ifndef ENABLE_TONE_MAP
+#define ENABLE_TONE_MAP 1
+#endif
+#ifndef ENABLE_VIGNETTE
+#define ENABLE_VIGNETTE 1
+#endif
+
+// Storm permutation (see fragment.glsl)
+#ifdef WEATHER_STORM
+#define STORM_ACTIVE bool(WEATHER_STORM)
+#else
+#define STORM_ACTIVE (uWeatherIntensity > 0.5)
+#endif
+
+out vec4 FragColor;
+in vec2 TexCoord;
+
+uniform sampler2D uScene;
+uniform sampler2D uBloom;    // half-resolution output of the bloom_upsample chain
+uniform vec2 uPixel;
+uniform float uTime;
+uniform float uTimeOfDay;
+uniform float uWeatherIntensity;
+uniform float uBloomIntensity;
+uniform vec2 uRenderScale;   // dynamic resolution, see composite.frag
+uniform vec2 uBloomPixel;    // texel size of uBloom
+
+#if ENABLE_OUTLINE
+uniform sampler2D uGBuffer; // packed normal + depth (see fragment.glsl)
+uniform float uDepthLogRange; // log2(uFarPlane / uNearPlane)
+uniform float uEdgeScale; // line width scaling
+uniform vec3 uEdgeColor;  // edge line color
+#endif
+
+#if ENABLE_SPIRAL
+uniform float uSpiralIntensity; // 0.0 = no effect, 1.0 = full spiral
+uniform vec2 uSpiralCenter;     // center point of spiral effect
+uniform float uSpiralRadius;    // radius of spiral effect
+#endif
+
+#if ENABLE_COLOR_GRADE
+// Color grading parameters
+uniform float uLift;
+uniform float uGamma2;
+uniform float uGain;
+uniform float uSaturation;
+#endif
+
+#if ENABLE_TONE_MAP
+uniform float uExposure;
+uniform float uGamma;
+#endif
+
+#if ENABLE_SPIRAL
+// See spiral.frag
+vec2 spiralWarp(vec2 uv, float distance) {
+    vec2 center = uSpiralCenter;
+    vec2 delta = uv - center;
+
+    if (distance < uSpiralRadius && uSpiralIntensity > 0.0) {
+        float angle = atan(delta.y, delta.x);
+        float spiral = uSpiralIntensity * (1.0 - distance / uSpiralRadius);
+
+        float timeSpiral = uTime * 0.5 + distance * 8.0;
+        float spiralSpeed = mix(1.0, 2.0, 1.0 - uTimeOfDay); // Faster at night
+        angle += spiral * sin(timeSpiral * spiralSpeed) * 0.3;
+
+        float newDistance = distance * (1.0 + spiral * 0.1 * sin(timeSpiral));
+        vec2 spiralUV = center + vec2(cos(angle), sin(angle)) * newDistance;
+
+        uv = mix(uv, spiralUV, spiral);
+    }
+    return uv;
+}
+
+vec3 spiralGlow(float distance) {
+    if (distance < uSpiralRadius * 0.8 && uSpiralIntensity > 0.3) {
+        float glow = (1.0 - distance / (uSpiralRadius * 0.8)) * uSpiralIntensity;
+        vec3 glowColor = mix(
+            vec3(0.0, 0.75, 1.0),  // Neon blue
+            vec3(1.0, 0.70, 0.07), // Neon orange
+            uTimeOfDay
+        );
+        return glowColor * glow * 0.1 * sin(uTime * 3.0 + distance * 10.0);
+    }
+    return vec3(0.0);
+}
+#endif
+
+#if ENABLE_OUTLINE
+// See outline.frag
+vec3 octDecode(vec2 f) {
+    vec3 n = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+    float t = clamp(-n.z, 0.0, 1.0);
+    n.x += n.x >= 0.0 ? -t : t;
+    n.y += n.y >= 0.0 ? -t : t;
+    return normalize(n);
+}
+
+// Decoded normal in xyz, encoded log2 depth in w (see fragment.glsl)
+vec4 readGBuffer(vec2 uv) {
+    vec4 g = texture(uGBuffer, min(uv, uRenderScale - 0.5 * uPixel));
+    float depth = dot(floor(g.ba * 255.0 + 0.5), vec2(256.0, 1.0)) / 65535.0;
+    return vec4(octDecode(g.rg * 2.0 - 1.0), depth);
+}
+
+// See outline.frag
+float planeDeviation(float a, float b, float c) {
+    return abs(exp2((c - a) * uDepthLogRange) + exp2((c - b) * uDepthLogRange) - 2.0);
+}
+
+vec4 outline(vec2 uv) {
+    vec4 gc = readGBuffer(uv);
+    vec4 g00 = readGBuffer(uv + vec2(-uPixel.x, -uPixel.y));
+    vec4 g10 = readGBuffer(uv + vec2( uPixel.x, -uPixel.y));
+    vec4 g01 = readGBuffer(uv + vec2(-uPixel.x,  uPixel.y));
+    vec4 g11 = readGBuffer(uv + vec2( uPixel.x,  uPixel.y));
+
+    float depthEdge = max(planeDeviation(g00.w, g11.w, gc.w), planeDeviation(g10.w, g01.w, gc.w));
+
+    float normalEdge = length(g10.xyz - g00.xyz) + length(g11.xyz - g01.xyz);
+
+    float edge = max(depthEdge, normalEdge * 0.5);
+    float threshold = mix(0.015, 0.025, uTimeOfDay); // Thinner lines at night
+    float edgeStrength = smoothstep(threshold, threshold + 0.01, edge) * uEdgeScale;
+
+    vec3 finalEdgeColor = mix(vec3(0.0), uEdgeColor, 1.0 - uTimeOfDay);
+    return vec4(finalEdgeColor, edgeStrength);
+}
+#endif
+
+#if ENABLE_COLOR_GRADE
+// See composite.frag
+vec3 colorGrade(vec3 color) {
+    color = pow(color + uLift, vec3(1.0 / uGamma2)) * uGain;
+
+    float luminance = dot(color, vec3(0.2126, 0.7152, 0.0722));
+    color = mix(vec3(luminance), color, uSaturation);
+
+    float blueBias = mix(0.1, 0.3, 1.0 - uTimeOfDay);
+    color.b += blueBias * (1.0 - color.b);
+
+    if (STORM_ACTIVE) {
+        color = mix(color, vec3(dot(color, vec3(0.299, 0.587, 0.114))), uWeatherIntensity * 0.3);
+        color *= (1.0 - uWeatherIntensity * 0.2);
+    }
+
+    return color;
+}
+#endif
+
+#if ENABLE_TONE_MAP
+// See composite.frag
+vec3 toneMap(vec3 color) {
+    color *= uExposure;
+
+    vec3 mapped = color / (color + vec3(1.0));
+
+    float neonFactor = max(
+        smoothstep(0.8, 1.0, color.r * color.g * 0.5), // Orange preservation
+        smoothstep(0.8, 1.0, color.g * color.b * 0.5)  // Blue preservation
+    );
+    mapped = mix(mapped, color * 0.8, neonFactor * 0.3);
+
+    return pow(mapped, vec3(1.0 / uGamma));
+}
+#endif
+
+void main() {
+    vec2 uv = TexCoord;
+
+#if ENABLE_SPIRAL
+    float spiralDistance = length(uv - uSpiralCenter);
+    uv = spiralWarp(uv, spiralDistance);
+#endif
+
+    vec2 sceneUV = min(uv * uRenderScale, uRenderScale - 0.5 * uPixel);
+    vec3 scene = texture(uScene, sceneUV).rgb;
+    vec3 bloom = texture(uBloom, min(uv * uRenderScale, uRenderScale - 0.5 * uBloomPixel)).rgb;
+
+    float bloomIntensity = mix(uBloomIntensity * 0.7, uBloomIntensity * 1.3, 1.0 - uTimeOfDay);
+    vec3 color = scene + bloom * bloomIntensity;
+
+#if ENABLE_COLOR_GRADE
+    color = colorGrade(color);
+#endif
+
+#if ENABLE_TONE_MAP
+    color = toneMap(color);
+#endif
+
+#if ENABLE_OUTLINE
+    vec4 edge = outline(sceneUV);
+    color = mix(color, edge.rgb, edge.a);
+#endif
+
+    // Final atmospheric adjustments
+    float atmosphericIntensity = mix(0.95, 1.05, sin(uTimeOfDay * 3.14159));
+    color *= atmosphericIntensity;
+
+#if ENABLE_VIGNETTE
+    // Warped UV: the multi-pass spiral samples the already-vignetted composite
+    vec2 center = uv - 0.5;
+    color *= 1.0 - dot(center, center) * 0.3;
+#endif
+
+#if ENABLE_SPIRAL
+    color += spiralGlow(spiralDistance);
+#endif
+
+    FragColor = vec4(color, 1.0);
+}
@@ -4,14 +4,29 @@ layout(location = 1) in vec3 aNormal;
 
 out vec3 vNormal;
 out vec3 vPos;
+out float vViewDepth; // view-space depth, written to the G-buffer
+flat out vec3 vBaseColor;
+flat out vec3 vAccent1;
+flat out vec3 vAccent2;
 
 uniform mat4 uModel;
+uniform mat3 uNormalMatrix; // transpose(inverse(mat3(uModel))), computed once per object on the CPU
 uniform mat4 uView;
 uniform mat4 uProj;
 
+// Per-object material, forwarded so fragment.glsl is shared with vertex_instanced.glsl
+uniform vec3 uBaseColor;  // e.g., vec3(0.18, 0.25, 0.33) deep blue
+uniform vec3 uAccent1;    // vec3(1.0, 0.70, 0.07) neon orange
+uniform vec3 uAccent2;    // vec3(0.0, 0.75, 1.0) neon blue
+
 void main() {
     vec4 worldPos = uModel * vec4(aPos, 1.0);
     vPos = worldPos.xyz;
-    vNormal = mat3(transpose(inverse(uModel))) * aNormal;
-    gl_Position = uProj * uView * worldPos;
+    vNormal = uNormalMatrix * aNormal;
+    vBaseColor = uBaseColor;
+    vAccent1 = uAccent1;
+    vAccent2 = uAccent2;
+    vec4 viewPos = uView * worldPos;
+    vViewDepth = -viewPos.z;
+    gl_Position = uProj * viewPos;
 }
@@ -0,0 +1,39 @@
+#version 330 core
+// Camera-facing impostor quads for far platforms, drawn instanced and shaded
+// by fragment.glsl with IMPOSTOR 1.
+layout(location = 0) in vec2 aCorner;      // quad corner in [-0.5, 0.5]
+
+layout(location = 2) in vec3 aCenter;      // world-space platform center
+layout(location = 3) in vec2 aSize;        // world-space quad width and height
+layout(location = 4) in vec4 aAtlasRect;   // xy = offset, zw = size in uImpostorAtlas
+layout(location = 5) in vec3 aBaseColor;   // same material as the mesh levels
+layout(location = 6) in vec3 aAccent1;
+layout(location = 7) in vec3 aAccent2;
+
+out vec2 vUV;
+out vec3 vPos;
+out float vViewDepth; // see vertex.glsl
+flat out float vImpostorDepthRange; // scale of the atlas depth offset
+flat out vec3 vBaseColor;
+flat out vec3 vAccent1;
+flat out vec3 vAccent2;
+
+uniform mat4 uView;
+uniform mat4 uProj;
+
+void main() {
+    // Camera right and up vectors are the first two rows of the view matrix
+    vec3 right = vec3(uView[0][0], uView[1][0], uView[2][0]);
+    vec3 up = vec3(uView[0][1], uView[1][1], uView[2][1]);
+
+    vec3 worldPos = aCenter + right * (aCorner.x * aSize.x) + up * (aCorner.y * aSize.y);
+    vPos = worldPos;
+    vUV = aAtlasRect.xy + (aCorner + 0.5) * aAtlasRect.zw;
+    vImpostorDepthRange = max(aSize.x, aSize.y);
+    vBaseColor = aBaseColor;
+    vAccent1 = aAccent1;
+    vAccent2 = aAccent2;
+    vec4 viewPos = uView * vec4(worldPos, 1.0);
+    vViewDepth = -viewPos.z;
+    gl_Position = uProj * viewPos;
+}
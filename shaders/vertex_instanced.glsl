@@ -0,0 +1,33 @@
+#version 330 core
+// Instanced variant of vertex.glsl: one draw call per mesh/material batch.
+// Transform and colors come from a per-instance buffer (glVertexAttribDivisor = 1).
+layout(location = 0) in vec3 aPos;
+layout(location = 1) in vec3 aNormal;
+
+layout(location = 2) in mat4 aModel;        // locations 2-5
+layout(location = 6) in mat3 aNormalMatrix; // locations 6-8, transpose(inverse(mat3(aModel)))
+layout(location = 9) in vec3 aBaseColor;
+layout(location = 10) in vec3 aAccent1;
+layout(location = 11) in vec3 aAccent2;
+
+out vec3 vNormal;
+out vec3 vPos;
+out float vViewDepth; // view-space depth, written to the G-buffer
+flat out vec3 vBaseColor;
+flat out vec3 vAccent1;
+flat out vec3 vAccent2;
+
+uniform mat4 uView;
+uniform mat4 uProj;
+
+void main() {
+    vec4 worldPos = aModel * vec4(aPos, 1.0);
+    vPos = worldPos.xyz;
+    vNormal = aNormalMatrix * aNormal;
+    vBaseColor = aBaseColor;
+    vAccent1 = aAccent1;
+    vAccent2 = aAccent2;
+    vec4 viewPos = uView * worldPos;
+    vViewDepth = -viewPos.z;
+    gl_Position = uProj * viewPos;
+}